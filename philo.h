@@ -6,7 +6,7 @@
 /*   By: yzhang2 <yzhang2@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/16 00:00:00 by yzhang2           #+#    #+#             */
-/*   Updated: 2026/01/30 15:39:07 by yzhang2          ###   ########.fr       */
+/*   Updated: 2026/10/20 10:31:05 by yzhang2          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -20,6 +20,18 @@
 # include <sys/time.h>
 # include <unistd.h>
 
+/*
+ * 节能模式开关（make eco 时为 1）：只决定 t_sim 里有没有节能模式的字段。
+ * 行为由 Makefile 选择编译 src/poll_*.c（轮询）还是 src/eco_*.c（阻塞）。
+ */
+# ifndef PHILO_ECO
+#  define PHILO_ECO 0
+# endif
+
+# if PHILO_ECO
+#  include <sys/resource.h>
+# endif
+
 typedef struct s_sim
 {
 	int				count;
@@ -30,6 +42,7 @@ typedef struct s_sim
 
 	int				stop;
 	long			start_ms;
+	long			died_late;
 
 	int				fork_inited;
 	int				meal_inited;
@@ -39,6 +52,14 @@ typedef struct s_sim
 	pthread_mutex_t	*forks;
 	pthread_mutex_t	print_lock;
 	pthread_mutex_t	state_lock;
+# if PHILO_ECO
+
+	int				cond_inited;
+	int				full;
+	long			wakeups;
+	pthread_cond_t	stop_cond;
+	pthread_cond_t	watch_cond;
+# endif
 }					t_sim;
 
 typedef struct s_philo
@@ -54,24 +75,41 @@ typedef struct s_philo
 }					t_philo;
 
 int					sim_parse(int argc, char **argv, t_sim *sim);
+int					sim_run(t_sim *sim);
 
 int					sim_init_mutex(t_sim *sim);
 int					sim_init_philo(t_sim *sim, t_philo *ph);
 
 long				time_ms(void);
 long				think_ms(t_sim *sim);
-void				wait_until_stop(t_sim *sim, long ms);
 
 int					stop_get(t_sim *sim);
 void				stop_set(t_sim *sim);
 void				log_msg(t_sim *sim, int id, const char *msg, int force);
 int					philo_done(t_philo *p);
+void				meal_start(t_philo *p);
 
 void				*philo_thread(void *arg);
 int					start_philos(t_sim *sim, t_philo *ph, pthread_t *th);
 void				join_philos(pthread_t *th, int n);
 
+long				read_last_meal(t_philo *p);
+int					all_full(t_sim *sim, t_philo *ph);
+int					scan_dead(t_sim *sim, t_philo *ph);
+
+/* 按模式二选一：src/poll_*.c 或 src/eco_*.c */
+void				wait_until_stop(t_sim *sim, long ms);
 void				*watch_thread(void *arg);
+int					mode_init(t_sim *sim);
+void				mode_release(t_sim *sim);
+void				mode_wake(t_sim *sim);
+void				mode_full(t_sim *sim);
+void				mode_report(t_sim *sim);
+
+# if PHILO_ECO
+
+void				ms_to_ts(long ms, struct timespec *ts);
+# endif
 
 int					print_err(const char *msg);
 void				sim_release(t_sim *sim, t_philo *ph, pthread_t *th);
@@ -6,7 +6,7 @@
 /*   By: yzhang2 <yzhang2@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/16 00:13:13 by yzhang2           #+#    #+#             */
-/*   Updated: 2026/01/30 16:23:50 by yzhang2          ###   ########.fr       */
+/*   Updated: 2026/10/20 09:12:44 by yzhang2          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -54,6 +54,7 @@ void	sim_release(t_sim *sim, t_philo *ph, pthread_t *th)
 		pthread_mutex_destroy(&sim->print_lock);
 	if (sim->state_inited)
 		pthread_mutex_destroy(&sim->state_lock);
+	mode_release(sim);
 	if (th)
 		free(th);
 	if (sim->forks)
@@ -0,0 +1,66 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   eco_hook.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yzhang2 <yzhang2@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 09:24:10 by yzhang2           #+#    #+#             */
+/*   Updated: 2026/10/20 09:18:21 by yzhang2          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/* 节能模式的资源：两个条件变量 + 统计计数（失败时由 mode_release 回收） */
+int	mode_init(t_sim *sim)
+{
+	sim->cond_inited = 0;
+	sim->full = 0;
+	sim->wakeups = 0;
+	if (pthread_cond_init(&sim->stop_cond, NULL) != 0)
+		return (1);
+	sim->cond_inited = 1;
+	if (pthread_cond_init(&sim->watch_cond, NULL) != 0)
+		return (1);
+	sim->cond_inited = 2;
+	return (0);
+}
+
+/* 只销毁已初始化的条件变量 */
+void	mode_release(t_sim *sim)
+{
+	if (sim->cond_inited >= 1)
+		pthread_cond_destroy(&sim->stop_cond);
+	if (sim->cond_inited >= 2)
+		pthread_cond_destroy(&sim->watch_cond);
+}
+
+/* stop 刚被设置（持有 state_lock）：叫醒所有哲学家和监控线程 */
+void	mode_wake(t_sim *sim)
+{
+	pthread_cond_broadcast(&sim->stop_cond);
+	pthread_cond_signal(&sim->watch_cond);
+}
+
+/* 有人刚好吃够 must_eat 次：计数，只叫醒监控线程 */
+void	mode_full(t_sim *sim)
+{
+	pthread_mutex_lock(&sim->state_lock);
+	sim->full += 1;
+	pthread_cond_signal(&sim->watch_cond);
+	pthread_mutex_unlock(&sim->state_lock);
+}
+
+/* 结束时把唤醒次数和进程 CPU 时间打印到标准错误（不影响日志输出） */
+void	mode_report(t_sim *sim)
+{
+	struct rusage	ru;
+	double			cpu;
+
+	if (getrusage(RUSAGE_SELF, &ru) != 0)
+		return ;
+	cpu = (double)(ru.ru_utime.tv_sec + ru.ru_stime.tv_sec)
+		+ (double)(ru.ru_utime.tv_usec + ru.ru_stime.tv_usec) / 1000000.0;
+	fprintf(stderr, "wakeups: %ld, cpu: %.3fs\n", sim->wakeups, cpu);
+}
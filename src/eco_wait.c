@@ -0,0 +1,40 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   eco_wait.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yzhang2 <yzhang2@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 09:26:48 by yzhang2           #+#    #+#             */
+/*   Updated: 2026/10/20 09:18:21 by yzhang2          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/* 把绝对毫秒时间（和 time_ms 同一个时钟）转成 timedwait 用的 timespec */
+void	ms_to_ts(long ms, struct timespec *ts)
+{
+	ts->tv_sec = ms / 1000L;
+	ts->tv_nsec = (ms % 1000L) * 1000000L;
+}
+
+/*
+ * 节能版 wait_until_stop：在 stop_cond 上一直睡到截止时刻，
+ * 只有 stop_set 广播或超时才醒来，不再每 250us 轮询一次。
+ */
+void	wait_until_stop(t_sim *sim, long ms)
+{
+	long			end;
+	struct timespec	ts;
+
+	end = time_ms() + ms;
+	ms_to_ts(end, &ts);
+	pthread_mutex_lock(&sim->state_lock);
+	while (!sim->stop && time_ms() < end)
+	{
+		pthread_cond_timedwait(&sim->stop_cond, &sim->state_lock, &ts);
+		sim->wakeups += 1;
+	}
+	pthread_mutex_unlock(&sim->state_lock);
+}
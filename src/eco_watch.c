@@ -0,0 +1,83 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   eco_watch.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yzhang2 <yzhang2@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:23:12 by yzhang2           #+#    #+#             */
+/*   Updated: 2026/10/20 09:28:15 by yzhang2          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/* 所有人都吃够了吗（调用时必须持有 state_lock） */
+static int	eco_all_full(t_sim *sim)
+{
+	return (sim->must_eat > 0 && sim->full >= sim->count);
+}
+
+/*
+ * 计算最早的死亡截止时刻：min(last_meal) + die_ms。
+ * last_meal 只会往后推，所以在这个时刻醒来重新扫描不会漏掉死亡。
+ */
+static long	next_deadline(t_sim *sim, t_philo *ph)
+{
+	int		i;
+	long	next;
+	long	t;
+
+	next = LONG_MAX;
+	i = 0;
+	while (i < sim->count)
+	{
+		t = read_last_meal(&ph[i]) + sim->die_ms;
+		if (t < next)
+			next = t;
+		i++;
+	}
+	return (next);
+}
+
+/*
+ * 在 watch_cond 上睡到截止时刻（或被 stop / 吃够 叫醒），
+ * 返回 1 表示模拟该结束了。哲学家睡在 stop_cond 上，不会被这里吵醒。
+ */
+static int	watch_wait(t_sim *sim, long until)
+{
+	struct timespec	ts;
+	int				done;
+
+	ms_to_ts(until, &ts);
+	pthread_mutex_lock(&sim->state_lock);
+	while (!sim->stop && !eco_all_full(sim) && time_ms() < until)
+	{
+		pthread_cond_timedwait(&sim->watch_cond, &sim->state_lock, &ts);
+		sim->wakeups += 1;
+	}
+	if (!sim->stop && eco_all_full(sim))
+	{
+		sim->stop = 1;
+		pthread_cond_broadcast(&sim->stop_cond);
+	}
+	done = sim->stop;
+	pthread_mutex_unlock(&sim->state_lock);
+	return (done);
+}
+
+/* 节能版监控线程：扫描一次死亡，然后只睡到下一个截止时刻 */
+void	*watch_thread(void *arg)
+{
+	t_philo	*ph;
+	t_sim	*sim;
+
+	ph = (t_philo *)arg;
+	sim = ph[0].sim;
+	while (!scan_dead(sim, ph))
+	{
+		if (watch_wait(sim, next_deadline(sim, ph)))
+			break ;
+	}
+	return (NULL);
+}
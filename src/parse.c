@@ -6,7 +6,7 @@
 /*   By: yzhang2 <yzhang2@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/16 00:09:40 by yzhang2           #+#    #+#             */
-/*   Updated: 2025/12/16 01:07:21 by yzhang2          ###   ########.fr       */
+/*   Updated: 2026/10/20 10:31:40 by yzhang2          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -81,6 +81,7 @@ int	sim_parse(int argc, char **argv, t_sim *sim)
 		return (1);
 	sim->stop = 0;
 	sim->start_ms = 0;
+	sim->died_late = -1;
 	sim->fork_inited = 0;
 	sim->meal_inited = 0;
 	sim->print_inited = 0;
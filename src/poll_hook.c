@@ -0,0 +1,49 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   poll_hook.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yzhang2 <yzhang2@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 09:20:36 by yzhang2           #+#    #+#             */
+/*   Updated: 2026/10/20 09:18:21 by yzhang2          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/*
+ * 默认（轮询）模式的钩子：轮询版不需要额外资源，
+ * 这些函数什么都不做。节能模式用 eco_hook.c 替换本文件。
+ */
+
+/* 初始化模式相关的资源 */
+int	mode_init(t_sim *sim)
+{
+	(void)sim;
+	return (0);
+}
+
+/* 释放模式相关的资源 */
+void	mode_release(t_sim *sim)
+{
+	(void)sim;
+}
+
+/* stop 刚被设置（持有 state_lock）：叫醒阻塞的线程 */
+void	mode_wake(t_sim *sim)
+{
+	(void)sim;
+}
+
+/* 有人刚好吃够 must_eat 次 */
+void	mode_full(t_sim *sim)
+{
+	(void)sim;
+}
+
+/* 模拟结束、线程都回收之后输出统计 */
+void	mode_report(t_sim *sim)
+{
+	(void)sim;
+}
@@ -0,0 +1,27 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   poll_wait.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yzhang2 <yzhang2@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 09:15:12 by yzhang2           #+#    #+#             */
+/*   Updated: 2026/10/20 09:15:12 by yzhang2          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/* 可被停止信号打断的睡眠：模拟结束时尽快醒来退出 */
+void	wait_until_stop(t_sim *sim, long ms)
+{
+	long	start;
+
+	start = time_ms();
+	while (time_ms() - start < ms)
+	{
+		if (stop_get(sim))
+			break ;
+		usleep(250);
+	}
+}
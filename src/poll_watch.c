@@ -0,0 +1,35 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   poll_watch.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yzhang2 <yzhang2@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 09:17:03 by yzhang2           #+#    #+#             */
+/*   Updated: 2026/10/20 09:17:03 by yzhang2          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/* 监控线程：循环检查死亡和吃够次数，控制模拟结束 */
+void	*watch_thread(void *arg)
+{
+	t_philo	*ph;
+	t_sim	*sim;
+
+	ph = (t_philo *)arg;
+	sim = ph[0].sim;
+	while (!stop_get(sim))
+	{
+		if (scan_dead(sim, ph))
+			return (NULL);
+		if (all_full(sim, ph))
+		{
+			stop_set(sim);
+			return (NULL);
+		}
+		usleep(1000);
+	}
+	return (NULL);
+}
@@ -6,7 +6,7 @@
 /*   By: yzhang2 <yzhang2@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/16 00:11:25 by yzhang2           #+#    #+#             */
-/*   Updated: 2026/01/30 19:04:09 by yzhang2          ###   ########.fr       */
+/*   Updated: 2026/10/19 10:17:10 by yzhang2          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -47,10 +47,7 @@ static void	eat_once(t_philo *p)
 	}
 	pthread_mutex_lock(sec);
 	log_msg(sim, p->id, "has taken a fork", 0);
-	pthread_mutex_lock(&p->meal_lock);
-	p->last_meal = time_ms();
-	p->meals += 1;
-	pthread_mutex_unlock(&p->meal_lock);
+	meal_start(p);
 	log_msg(sim, p->id, "is eating", 0);
 	wait_until_stop(sim, sim->eat_ms);
 	pthread_mutex_unlock(sec);
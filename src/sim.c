@@ -0,0 +1,80 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sim.c                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yzhang2 <yzhang2@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:02:37 by yzhang2           #+#    #+#             */
+/*   Updated: 2026/10/20 09:18:21 by yzhang2          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/* 初始化模式相关的资源 + 分配内存 + 初始化锁 + 初始化每个哲学家的数据 */
+static int	sim_build(t_sim *sim, t_philo **ph, pthread_t **th)
+{
+	if (mode_init(sim) != 0)
+	{
+		sim_release(sim, NULL, NULL);
+		return (print_err("init failed"));
+	}
+	sim->forks = malloc(sizeof(*sim->forks) * sim->count);
+	*ph = malloc(sizeof(**ph) * sim->count);
+	*th = malloc(sizeof(**th) * sim->count);
+	if (!sim->forks || !*ph || !*th)
+	{
+		sim_release(sim, *ph, *th);
+		return (print_err("malloc failed"));
+	}
+	if (sim_init_mutex(sim) != 0 || sim_init_philo(sim, *ph) != 0)
+	{
+		sim_release(sim, *ph, *th);
+		return (print_err("init failed"));
+	}
+	return (0);
+}
+
+/* 启动哲学家线程 + 启动监控线程 */
+static int	sim_start(t_sim *sim, t_philo *ph, pthread_t *th, pthread_t *watch)
+{
+	if (start_philos(sim, ph, th) != 0)
+		return (1);
+	if (pthread_create(watch, NULL, watch_thread, ph) != 0)
+	{
+		stop_set(sim);
+		join_philos(th, sim->count);
+		return (print_err("watch thread failed"));
+	}
+	return (0);
+}
+
+/* 等待线程结束 + 输出模式统计 + 清理所有资源 */
+static void	sim_finish(t_sim *sim, t_philo *ph, pthread_t *th, pthread_t watch)
+{
+	pthread_join(watch, NULL);
+	join_philos(th, sim->count);
+	mode_report(sim);
+	sim_release(sim, ph, th);
+}
+
+/* 搭建、运行并收尾一次完整的模拟（sim 需先经过 sim_parse） */
+int	sim_run(t_sim *sim)
+{
+	t_philo		*ph;
+	pthread_t	*th;
+	pthread_t	watch;
+
+	ph = NULL;
+	th = NULL;
+	if (sim_build(sim, &ph, &th) != 0)
+		return (1);
+	if (sim_start(sim, ph, th, &watch) != 0)
+	{
+		sim_release(sim, ph, th);
+		return (1);
+	}
+	sim_finish(sim, ph, th, watch);
+	return (0);
+}
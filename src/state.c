@@ -6,7 +6,7 @@
 /*   By: yzhang2 <yzhang2@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/16 00:11:06 by yzhang2           #+#    #+#             */
-/*   Updated: 2026/01/30 15:39:27 by yzhang2          ###   ########.fr       */
+/*   Updated: 2026/10/20 09:13:30 by yzhang2          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -23,11 +23,12 @@ int	stop_get(t_sim *sim)
 	return (v);
 }
 
-/* 设置 stop 标志：告诉所有线程该结束了 */
+/* 设置 stop 标志：告诉所有线程该结束了（并叫醒正在阻塞等待的线程） */
 void	stop_set(t_sim *sim)
 {
 	pthread_mutex_lock(&sim->state_lock);
 	sim->stop = 1;
+	mode_wake(sim);
 	pthread_mutex_unlock(&sim->state_lock);
 }
 
@@ -63,3 +64,17 @@ int	philo_done(t_philo *p)
 	pthread_mutex_unlock(&p->meal_lock);
 	return (done);
 }
+
+/* 记录一次开饭：更新 last_meal 和吃饭次数，刚好吃够时通知一下 */
+void	meal_start(t_philo *p)
+{
+	int	meals;
+
+	pthread_mutex_lock(&p->meal_lock);
+	p->last_meal = time_ms();
+	p->meals += 1;
+	meals = p->meals;
+	pthread_mutex_unlock(&p->meal_lock);
+	if (meals == p->sim->must_eat)
+		mode_full(p->sim);
+}
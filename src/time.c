@@ -6,7 +6,7 @@
 /*   By: yzhang2 <yzhang2@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/16 00:10:44 by yzhang2           #+#    #+#             */
-/*   Updated: 2026/01/30 15:27:46 by yzhang2          ###   ########.fr       */
+/*   Updated: 2026/10/20 09:14:05 by yzhang2          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -22,20 +22,6 @@ long	time_ms(void)
 	return (tv.tv_sec * 1000L + tv.tv_usec / 1000L);
 }
 
-/* 可被停止信号打断的睡眠：模拟结束时尽快醒来退出 */
-void	wait_until_stop(t_sim *sim, long ms)
-{
-	long	start;
-
-	start = time_ms();
-	while (time_ms() - start < ms)
-	{
-		if (stop_get(sim))
-			break ;
-		usleep(250);
-	}
-}
-
 /*
  * 计算 thinking 应该等待多久（毫秒）。
  * 目的：让大家不要“同一时刻一起抢叉”，减少饥饿概率。
@@ -0,0 +1,59 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   burn.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yzhang2 <yzhang2@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:29:52 by yzhang2           #+#    #+#             */
+/*   Updated: 2026/10/19 11:29:52 by yzhang2          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "stress.h"
+
+/* 启动 n 个空转进程占满 CPU，用来制造超额订阅（oversubscription） */
+pid_t	*burn_start(int n)
+{
+	pid_t	*pids;
+	int		i;
+
+	if (n <= 0)
+		return (NULL);
+	pids = malloc(sizeof(*pids) * n);
+	if (!pids)
+		return (NULL);
+	fflush(stdout);
+	i = 0;
+	while (i < n)
+	{
+		pids[i] = fork();
+		if (pids[i] == 0)
+		{
+			while (1)
+				;
+		}
+		i++;
+	}
+	return (pids);
+}
+
+/* 杀掉并回收所有空转进程 */
+void	burn_stop(pid_t *pids, int n)
+{
+	int	i;
+
+	if (!pids)
+		return ;
+	i = 0;
+	while (i < n)
+	{
+		if (pids[i] > 0)
+		{
+			kill(pids[i], SIGKILL);
+			waitpid(pids[i], NULL, 0);
+		}
+		i++;
+	}
+	free(pids);
+}
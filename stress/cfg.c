@@ -0,0 +1,62 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cfg.c                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yzhang2 <yzhang2@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 11:05:12 by yzhang2           #+#    #+#             */
+/*   Updated: 2026/10/20 09:18:21 by yzhang2          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <time.h>
+#include "stress.h"
+
+/* 把一个选项的值写进配置 */
+static int	set_opt(t_cfg *cfg, int opt, const char *arg)
+{
+	if (opt == 'n')
+		cfg->trials = atoi(arg);
+	else if (opt == 'j')
+		cfg->jobs = atoi(arg);
+	else if (opt == 'b')
+		cfg->burners = atoi(arg);
+	else if (opt == 'c')
+		cfg->max_count = atoi(arg);
+	else if (opt == 'd')
+		cfg->delay_us = atoi(arg);
+	else if (opt == 'y')
+		cfg->yield_pct = atoi(arg);
+	else if (opt == 's')
+		cfg->seed = (unsigned int)strtoul(arg, NULL, 10);
+	else if (opt == 'v')
+		cfg->verbose = 1;
+	else
+		return (1);
+	return (0);
+}
+
+/* 解析压力测试的参数，没给的用默认值 */
+int	parse_cfg(int argc, char **argv, t_cfg *cfg)
+{
+	int	opt;
+
+	cfg->trials = 50;
+	cfg->jobs = (int)sysconf(_SC_NPROCESSORS_ONLN);
+	cfg->burners = 0;
+	cfg->max_count = 200;
+	cfg->delay_us = 0;
+	cfg->yield_pct = 0;
+	cfg->seed = (unsigned int)time(NULL);
+	cfg->verbose = 0;
+	opt = getopt(argc, argv, "n:j:b:c:d:y:s:v");
+	while (opt != -1)
+	{
+		if (set_opt(cfg, opt, optarg) != 0)
+			return (1);
+		opt = getopt(argc, argv, "n:j:b:c:d:y:s:v");
+	}
+	return (cfg->trials < 1 || cfg->jobs < 1 || cfg->max_count < 1
+		|| cfg->delay_us < 0 || cfg->yield_pct < 0);
+}
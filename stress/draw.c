@@ -0,0 +1,88 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   draw.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yzhang2 <yzhang2@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:05:31 by yzhang2           #+#    #+#             */
+/*   Updated: 2026/10/20 10:35:30 by yzhang2          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <string.h>
+#include "stress.h"
+
+/* 在 [lo, hi] 里取一个随机整数（只在父进程里用，保证同一个 seed 可复现） */
+static int	rand_between(int lo, int hi)
+{
+	return (lo + rand() % (hi - lo + 1));
+}
+
+/*
+ * 理论上能活下来的最小 time_to_die：
+ * 偶数人时每人每两轮吃一次，奇数人时每三轮吃一次，且不能短于 吃 + 睡。
+ */
+static long	required_ms(int count, int eat_ms, int sleep_ms)
+{
+	long	need;
+
+	need = (long)eat_ms * 2;
+	if (count % 2 == 1)
+		need = (long)eat_ms * 3;
+	if (need < (long)eat_ms + sleep_ms)
+		need = (long)eat_ms + sleep_ms;
+	return (need);
+}
+
+/*
+ * 随机抽一组参数，time_to_die = 理论最小值 + slack。
+ * 每 10 组里第一组固定 1 个人（走 eat_once 的单叉分支），
+ * 约四分之一的组不给 must_eat，只跑 window_ms（约 10 个周期，取整到秒）。
+ * 结果先记为 T_ERROR，只有 trial_collect 收到子进程后才会改写。
+ */
+void	trial_draw(t_cfg *cfg, t_trial *t, int index)
+{
+	memset(t, 0, sizeof(*t));
+	t->count = rand_between(1, cfg->max_count);
+	if (index % 10 == 0)
+		t->count = 1;
+	t->eat_ms = rand_between(20, 120);
+	t->sleep_ms = rand_between(20, 120);
+	t->must_eat = rand_between(3, 7);
+	if (rand() % 4 == 0)
+		t->must_eat = 0;
+	if (t->must_eat == 0)
+		t->window_ms = ((long)(t->die_ms + t->eat_ms + t->sleep_ms)
+				* 10 / 1000 + 1) * 1000;
+	t->slack = rand_between(-20, 60);
+	t->die_ms = (int)(required_ms(t->count, t->eat_ms, t->sleep_ms) + t->slack);
+	if (t->die_ms < 1)
+		t->die_ms = 1;
+	t->seed = (unsigned int)rand();
+	t->latency = -1;
+	t->outcome = T_ERROR;
+}
+
+/* 在父子进程共享的内存里分配 n 组参数，结果先都记为 T_ERROR */
+t_trial	*trials_new(int n)
+{
+	t_trial	*ts;
+	int		i;
+
+	ts = mmap(NULL, sizeof(*ts) * n, PROT_READ | PROT_WRITE,
+			MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (ts == MAP_FAILED)
+		return (NULL);
+	memset(ts, 0, sizeof(*ts) * n);
+	i = -1;
+	while (++i < n)
+		ts[i].outcome = T_ERROR;
+	return (ts);
+}
+
+/* 释放 trials_new 分配的共享内存 */
+void	trials_free(t_trial *ts, int n)
+{
+	munmap(ts, sizeof(*ts) * n);
+}
@@ -0,0 +1,52 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   latency.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yzhang2 <yzhang2@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 11:13:08 by yzhang2           #+#    #+#             */
+/*   Updated: 2026/10/20 09:18:21 by yzhang2          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "stress.h"
+
+static int	cmp_long(const void *a, const void *b)
+{
+	long	x;
+	long	y;
+
+	x = *(const long *)a;
+	y = *(const long *)b;
+	return ((x > y) - (x < y));
+}
+
+/* 检测延迟的分布：p50 / p90 / p99 / max，以及超过 LATE_MS 的次数 */
+void	print_latency(t_cfg *cfg, t_trial *ts)
+{
+	long	*lat;
+	int		n;
+	int		late;
+	int		i;
+
+	lat = malloc(sizeof(*lat) * cfg->trials);
+	if (!lat)
+		return ;
+	n = 0;
+	late = 0;
+	i = -1;
+	while (++i < cfg->trials)
+	{
+		if (ts[i].outcome != T_DIED)
+			continue ;
+		lat[n++] = ts[i].latency;
+		late += (ts[i].latency > LATE_MS);
+	}
+	qsort(lat, n, sizeof(*lat), cmp_long);
+	if (n > 0)
+		printf("detection latency: p50 %ldms, p90 %ldms, p99 %ldms, max %ldms"
+			" over %d deaths, late (> %dms): %d\n", lat[n * 50 / 100],
+			lat[n * 90 / 100], lat[n * 99 / 100], lat[n - 1], n, LATE_MS, late);
+	free(lat);
+}
@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   log.c                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yzhang2 <yzhang2@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:26:15 by yzhang2           #+#    #+#             */
+/*   Updated: 2026/10/20 10:38:20 by yzhang2          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <string.h>
+#include "stress.h"
+
+/*
+ * 读子进程的日志：记住每个人最后一次 "is eating" 的时间戳，
+ * 遇到 died 就记为死亡，died 之后还有输出就记为违规。
+ * 检测延迟不从日志算：子进程已经把核心里量到的 died_late 写回 t->latency。
+ */
+static void	scan_log(t_trial *t, FILE *f, long *last)
+{
+	long	ts;
+	int		id;
+	char	msg[64];
+
+	while (fscanf(f, "%ld %d %63[^\n]", &ts, &id, msg) == 3)
+	{
+		if (t->outcome == T_DIED)
+			t->late_logs += 1;
+		else if (id < 1 || id > t->count)
+			continue ;
+		else if (strcmp(msg, "is eating") == 0)
+			last[id] = ts;
+		else if (strcmp(msg, "died") == 0)
+			t->outcome = T_DIED;
+	}
+}
+
+/*
+ * 时间窗口结束时还活着，就说明每个人在窗口最后 time_to_die 之内都吃过饭
+ * （多给 LATE_MS 容忍启动开销）。做不到说明模拟卡住了，监控也没发现。
+ */
+static int	made_progress(t_trial *t, long *last)
+{
+	int	id;
+
+	id = 1;
+	while (id <= t->count)
+	{
+		if (last[id] + t->die_ms + LATE_MS < t->window_ms)
+			return (0);
+		id++;
+	}
+	return (1);
+}
+
+/* 解析日志；按窗口结束的组如果没有进展证据，记为 hung 而不是 survived */
+static void	parse_log(t_trial *t, FILE *f)
+{
+	long	*last;
+
+	last = calloc(t->count + 1, sizeof(*last));
+	if (!last)
+	{
+		t->outcome = T_ERROR;
+		return ;
+	}
+	scan_log(t, f, last);
+	if (t->window_ms > 0 && t->outcome == T_SURVIVED
+		&& !made_progress(t, last))
+		t->outcome = T_HUNG;
+	free(last);
+}
+
+/* 子进程结束后：根据退出状态和日志给这组参数定结果，并删掉临时文件 */
+void	trial_collect(t_trial *t, int status)
+{
+	FILE	*f;
+
+	t->outcome = T_SURVIVED;
+	if (WIFSIGNALED(status) && WTERMSIG(status) == SIGALRM)
+		t->outcome = T_HUNG;
+	else if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+		t->outcome = T_ERROR;
+	else
+	{
+		f = fopen(t->path, "r");
+		if (!f)
+			t->outcome = T_ERROR;
+		else
+		{
+			parse_log(t, f);
+			fclose(f);
+		}
+	}
+	unlink(t->path);
+}
+
+/* -v 时每组参数打印一行：参数、slack、结果、检测延迟 */
+void	report_trial(t_trial *t)
+{
+	static const char	*names[] = {"survived", "died", "hung", "error"};
+
+	printf("%d %d %d %d %d slack=%ld -> %s", t->count, t->die_ms,
+		t->eat_ms, t->sleep_ms, t->must_eat, t->slack, names[t->outcome]);
+	if (t->outcome == T_DIED)
+		printf(" latency=%ldms", t->latency);
+	if (t->late_logs > 0)
+		printf(" logs_after_died=%d", t->late_logs);
+	printf("\n");
+}
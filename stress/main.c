@@ -0,0 +1,117 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   main.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yzhang2 <yzhang2@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:40:09 by yzhang2           #+#    #+#             */
+/*   Updated: 2026/10/20 11:07:40 by yzhang2          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <errno.h>
+#include "stress.h"
+
+/* 按 pid 找到对应的那组参数（找不到就是别的子进程） */
+static int	find_trial(t_trial *ts, int n, pid_t pid)
+{
+	int	i;
+
+	i = 0;
+	while (i < n)
+	{
+		if (ts[i].pid == pid)
+			return (i);
+		i++;
+	}
+	return (-1);
+}
+
+/* 抽下一组参数并启动它，返回 1 表示多了一个正在跑的子进程 */
+static int	spawn_one(t_cfg *cfg, t_trial *ts, int next)
+{
+	trial_draw(cfg, &ts[next], next);
+	if (trial_spawn(cfg, &ts[next]) != 0)
+	{
+		ts[next].outcome = T_ERROR;
+		return (0);
+	}
+	return (1);
+}
+
+/*
+ * 等一个子进程结束并收结果：返回 1 表示收回了一组，
+ * 0 表示被信号打断或不是 trial 的子进程，-1 表示已经没有子进程可等。
+ */
+static int	reap_one(t_cfg *cfg, t_trial *ts, int n)
+{
+	int		status;
+	int		i;
+	pid_t	pid;
+
+	pid = waitpid(-1, &status, 0);
+	if (pid < 0 && errno == EINTR)
+		return (0);
+	if (pid < 0)
+		return (-1);
+	i = find_trial(ts, n, pid);
+	if (i < 0)
+		return (0);
+	trial_collect(&ts[i], status);
+	if (cfg->verbose)
+		report_trial(&ts[i]);
+	return (1);
+}
+
+/* 扫描：最多同时跑 jobs 组，跑完一组就收结果再补一组 */
+static void	run_sweep(t_cfg *cfg, t_trial *ts)
+{
+	int	next;
+	int	running;
+	int	reaped;
+
+	next = 0;
+	running = 0;
+	while (next < cfg->trials || running > 0)
+	{
+		if (next < cfg->trials && running < cfg->jobs)
+		{
+			running += spawn_one(cfg, ts, next);
+			next++;
+		}
+		else
+		{
+			reaped = reap_one(cfg, ts, next);
+			if (reaped < 0)
+				break ;
+			running -= reaped;
+		}
+	}
+}
+
+/* 压力测试入口：用 seed 随机扫参数，带噪声跑模拟，最后输出性能包络 */
+int	main(int argc, char **argv)
+{
+	t_cfg	cfg;
+	t_trial	*ts;
+	pid_t	*burn;
+	int		fail;
+
+	if (parse_cfg(argc, argv, &cfg) != 0)
+		return (print_err("usage: philo_stress [-n trials] [-j jobs] "
+				"[-b burners] [-c max_count] [-d delay_us] [-y yield_pct] "
+				"[-s seed] [-v]"));
+	ts = trials_new(cfg.trials);
+	if (!ts)
+		return (print_err("mmap failed"));
+	printf("seed %u, jobs %d, burners %d, delay %dus, yield %d%%\n", cfg.seed,
+		cfg.jobs, cfg.burners, cfg.delay_us, cfg.yield_pct);
+	srand(cfg.seed);
+	burn = burn_start(cfg.burners);
+	run_sweep(&cfg, ts);
+	burn_stop(burn, cfg.burners);
+	fail = report_summary(&cfg, ts);
+	trials_free(ts, cfg.trials);
+	return (fail);
+}
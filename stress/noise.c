@@ -0,0 +1,66 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   noise.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yzhang2 <yzhang2@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:12:40 by yzhang2           #+#    #+#             */
+/*   Updated: 2026/10/19 11:12:40 by yzhang2          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <sched.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "noise.h"
+
+#undef pthread_mutex_lock
+#undef pthread_mutex_unlock
+
+t_noise						g_noise;
+static __thread unsigned int	g_seed;
+
+/*
+ * 一个噪声注入点：按 yield_pct 的概率让出 CPU，
+ * 再随机睡 0..delay_us 微秒。每个线程用自己的随机种子，互不加锁。
+ */
+static void	noise_point(void)
+{
+	unsigned int	r;
+	unsigned int	span;
+
+	if (g_noise.delay_us <= 0 && g_noise.yield_pct <= 0)
+		return ;
+	if (g_seed == 0)
+		g_seed = g_noise.seed ^ (unsigned int)(uintptr_t)&g_seed;
+	r = (unsigned int)rand_r(&g_seed);
+	if (g_noise.yield_pct > 0 && (int)(r % 100) < g_noise.yield_pct)
+		sched_yield();
+	if (g_noise.delay_us > 0)
+	{
+		span = (unsigned int)g_noise.delay_us + 1;
+		r = (unsigned int)rand_r(&g_seed) % span;
+		if (r > 0)
+			usleep(r);
+	}
+}
+
+/* 加锁：抢锁前注入一次噪声，拿到锁后再注入一次（拉长持锁时间） */
+int	noise_lock(pthread_mutex_t *m)
+{
+	int	ret;
+
+	noise_point();
+	ret = pthread_mutex_lock(m);
+	noise_point();
+	return (ret);
+}
+
+/* 解锁：放锁前注入一次噪声 */
+int	noise_unlock(pthread_mutex_t *m)
+{
+	noise_point();
+	return (pthread_mutex_unlock(m));
+}
@@ -0,0 +1,37 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   noise.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yzhang2 <yzhang2@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:10:14 by yzhang2           #+#    #+#             */
+/*   Updated: 2026/10/19 11:10:14 by yzhang2          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+ * 压力测试专用：编译核心代码时用 -include 强制包含本文件，
+ * 把 src/ 里所有的加锁/解锁调用替换成带调度噪声的版本。
+ */
+#ifndef NOISE_H
+# define NOISE_H
+
+# include <pthread.h>
+
+typedef struct s_noise
+{
+	int				delay_us;
+	int				yield_pct;
+	unsigned int	seed;
+}					t_noise;
+
+extern t_noise		g_noise;
+
+int					noise_lock(pthread_mutex_t *m);
+int					noise_unlock(pthread_mutex_t *m);
+
+# define pthread_mutex_lock(m) noise_lock(m)
+# define pthread_mutex_unlock(m) noise_unlock(m)
+
+#endif
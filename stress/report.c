@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   report.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yzhang2 <yzhang2@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:34:27 by yzhang2           #+#    #+#             */
+/*   Updated: 2026/10/20 11:12:31 by yzhang2          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "stress.h"
+
+/* 打印一个毫秒值，没有数据（还是初始哨兵值）时打印 n/a */
+static void	print_ms(const char *label, long v)
+{
+	if (v == LONG_MAX || v == LONG_MIN)
+		printf("%s n/a", label);
+	else
+		printf("%s %ldms", label, v);
+}
+
+/*
+ * 性能包络：活下来的组里最大的人数、最小的 slack，
+ * 以及仍然死掉的组里最大的 slack 和 slack > 0（理论上该活）却死了的组数。
+ * 1 个人的组注定会死，不算进包络。
+ */
+static void	scan_envelope(t_cfg *cfg, t_trial *ts, t_env *env)
+{
+	int	i;
+
+	env->max_count = 0;
+	env->min_slack = LONG_MAX;
+	env->max_dead = LONG_MIN;
+	env->bad = 0;
+	i = -1;
+	while (++i < cfg->trials)
+	{
+		if (ts[i].count == 1)
+			continue ;
+		if (ts[i].outcome == T_SURVIVED && ts[i].count > env->max_count)
+			env->max_count = ts[i].count;
+		if (ts[i].outcome == T_SURVIVED && ts[i].slack < env->min_slack)
+			env->min_slack = ts[i].slack;
+		if (ts[i].outcome == T_DIED && ts[i].slack > env->max_dead)
+			env->max_dead = ts[i].slack;
+		env->bad += (ts[i].outcome == T_DIED && ts[i].slack > 0);
+	}
+}
+
+/* 打印性能包络 */
+static void	print_envelope(t_cfg *cfg, t_trial *ts)
+{
+	t_env	env;
+
+	scan_envelope(cfg, ts, &env);
+	printf("envelope: max count survived %d,", env.max_count);
+	print_ms(" min slack survived", env.min_slack);
+	print_ms(", max slack died", env.max_dead);
+	printf(", deaths with slack > 0: %d\n", env.bad);
+}
+
+/*
+ * 汇总：各结果的数量 + 性能包络 + 检测延迟。
+ * 有卡死、出错、died 之后还有输出、或死亡检测晚于 LATE_MS 时返回 1。
+ */
+int	report_summary(t_cfg *cfg, t_trial *ts)
+{
+	int	cnt[4];
+	int	logs;
+	int	fail;
+	int	i;
+
+	cnt[T_SURVIVED] = 0;
+	cnt[T_DIED] = 0;
+	cnt[T_HUNG] = 0;
+	cnt[T_ERROR] = 0;
+	logs = 0;
+	fail = 0;
+	i = -1;
+	while (++i < cfg->trials)
+	{
+		cnt[ts[i].outcome] += 1;
+		logs += (ts[i].late_logs > 0);
+		fail |= (ts[i].outcome >= T_HUNG || ts[i].late_logs > 0
+				|| (ts[i].outcome == T_DIED && ts[i].latency > LATE_MS));
+	}
+	printf("trials: %d (survived %d, died %d, hung %d, error %d), "
+		"logs after died: %d\n", cfg->trials, cnt[T_SURVIVED], cnt[T_DIED],
+		cnt[T_HUNG], cnt[T_ERROR], logs);
+	print_envelope(cfg, ts);
+	print_latency(cfg, ts);
+	return (fail);
+}
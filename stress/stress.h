@@ -0,0 +1,94 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stress.h                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yzhang2 <yzhang2@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:15:03 by yzhang2           #+#    #+#             */
+/*   Updated: 2026/10/20 11:14:00 by yzhang2          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef STRESS_H
+# define STRESS_H
+
+# include <signal.h>
+# include <sys/mman.h>
+# include <sys/types.h>
+# include <sys/wait.h>
+# include "philo.h"
+# include "noise.h"
+
+# define LATE_MS 10
+
+enum e_outcome
+{
+	T_SURVIVED,
+	T_DIED,
+	T_HUNG,
+	T_ERROR
+};
+
+/* 命令行配置：扫描多少组参数、并发多少个、噪声多大 */
+typedef struct s_cfg
+{
+	int				trials;
+	int				jobs;
+	int				burners;
+	int				max_count;
+	int				delay_us;
+	int				yield_pct;
+	unsigned int	seed;
+	int				verbose;
+}					t_cfg;
+
+/*
+ * 一组随机参数以及它跑完之后的结果。
+ * 整个数组放在共享内存里，子进程可以直接写回 latency。
+ */
+typedef struct s_trial
+{
+	int				count;
+	int				die_ms;
+	int				eat_ms;
+	int				sleep_ms;
+	int				must_eat;
+	long			window_ms;
+	long			slack;
+	unsigned int	seed;
+
+	pid_t			pid;
+	char			path[64];
+
+	int				outcome;
+	long			latency;
+	int				late_logs;
+}					t_trial;
+
+/* 性能包络的统计结果 */
+typedef struct s_env
+{
+	int				max_count;
+	long			min_slack;
+	long			max_dead;
+	int				bad;
+}					t_env;
+
+t_trial				*trials_new(int n);
+void				trials_free(t_trial *ts, int n);
+
+int					parse_cfg(int argc, char **argv, t_cfg *cfg);
+
+void				trial_draw(t_cfg *cfg, t_trial *t, int index);
+int					trial_spawn(t_cfg *cfg, t_trial *t);
+void				trial_collect(t_trial *t, int status);
+
+pid_t				*burn_start(int n);
+void				burn_stop(pid_t *pids, int n);
+
+void				report_trial(t_trial *t);
+void				print_latency(t_cfg *cfg, t_trial *ts);
+int					report_summary(t_cfg *cfg, t_trial *ts);
+
+#endif
@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trial.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yzhang2 <yzhang2@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:21:48 by yzhang2           #+#    #+#             */
+/*   Updated: 2026/10/20 11:09:55 by yzhang2          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "stress.h"
+
+/* 没有 must_eat 的组：时间窗口到了就正常退出，是否算活下来由 parse_log 判断 */
+static void	on_window(int sig)
+{
+	(void)sig;
+	_exit(0);
+}
+
+/*
+ * 给子进程定时：有 must_eat 时超时用默认的 SIGALRM 杀掉（记为 hung）；
+ * 没有 must_eat 时只跑一个窗口，日志按行写出，窗口到了正常退出。
+ */
+static void	arm_timer(t_trial *t)
+{
+	long	cycle;
+
+	cycle = t->die_ms + t->eat_ms + t->sleep_ms;
+	if (t->must_eat > 0)
+	{
+		alarm((unsigned int)((t->must_eat + 2) * cycle * 4 / 1000 + 5));
+		return ;
+	}
+	setvbuf(stdout, NULL, _IOLBF, 0);
+	signal(SIGALRM, on_window);
+	alarm((unsigned int)(t->window_ms / 1000));
+}
+
+/* 把这组参数拼成 philo 的命令行，返回 argc（没有 must_eat 时是 5） */
+static int	build_argv(t_trial *t, char buf[5][16], char **argv)
+{
+	int	i;
+
+	snprintf(buf[0], 16, "%d", t->count);
+	snprintf(buf[1], 16, "%d", t->die_ms);
+	snprintf(buf[2], 16, "%d", t->eat_ms);
+	snprintf(buf[3], 16, "%d", t->sleep_ms);
+	snprintf(buf[4], 16, "%d", t->must_eat);
+	argv[0] = "philo";
+	i = -1;
+	while (++i < 5)
+		argv[i + 1] = buf[i];
+	argv[6] = NULL;
+	if (t->must_eat > 0)
+		return (6);
+	argv[5] = NULL;
+	return (5);
+}
+
+/* 子进程：打开噪声、把日志写进临时文件、跑一次完整模拟，写回检测延迟 */
+static void	child_run(t_cfg *cfg, t_trial *t, int fd)
+{
+	char	buf[5][16];
+	char	*argv[7];
+	t_sim	sim;
+	int		argc;
+
+	g_noise.delay_us = cfg->delay_us;
+	g_noise.yield_pct = cfg->yield_pct;
+	g_noise.seed = t->seed;
+	if (dup2(fd, STDOUT_FILENO) < 0)
+		_exit(2);
+	arm_timer(t);
+	argc = build_argv(t, buf, argv);
+	if (sim_parse(argc, argv, &sim) != 0 || sim_run(&sim) != 0)
+		_exit(3);
+	t->latency = sim.died_late;
+	fflush(stdout);
+	_exit(0);
+}
+
+/*
+ * fork 出一个子进程跑这组参数，返回 0 表示已经启动。
+ * t 在共享内存里，pid 只由父进程写，避免和子进程抢着写。
+ */
+int	trial_spawn(t_cfg *cfg, t_trial *t)
+{
+	int		fd;
+	pid_t	pid;
+
+	snprintf(t->path, sizeof(t->path), "/tmp/philo_stress.XXXXXX");
+	fd = mkstemp(t->path);
+	if (fd < 0)
+		return (1);
+	fflush(stdout);
+	pid = fork();
+	if (pid == 0)
+		child_run(cfg, t, fd);
+	t->pid = pid;
+	close(fd);
+	if (pid < 0)
+	{
+		unlink(t->path);
+		return (1);
+	}
+	return (0);
+}